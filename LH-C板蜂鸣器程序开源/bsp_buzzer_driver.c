@@ -9,6 +9,8 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Sep-19-2020     LionHeart       1. done
+  *  V1.1.0     Oct-19-2026     LionHeart       1. ӿʱTIM4ͣ񡢹ضʱӼٻָ
+  *  V1.2.0     Oct-19-2026     LionHeart       1. Ӳչֶ֧
   *
   @verbatim
   ==============================================================================
@@ -19,30 +21,26 @@
   */
 
 
-#include "buzzer_TIM_init.h"
+#include "bsp_buzzer_driver.h"
 #include "stm32f4xx_hal.h"
 
-extern TIM_HandleTypeDef re_htim4;
-
 /**
-  * @brief          ƷʱķƵֵ
+  * @brief          ưطʱķƵֵ
   * @param[in]      pscöʱķƵϵ
   * @param[in]      pwmöʱֵ
   * @retval         none
   */
 void buzzer_drv_on(uint16_t psc, uint16_t pwm)
 {
-    __HAL_TIM_PRESCALER(&re_htim4, psc);
-    __HAL_TIM_SetCompare(&re_htim4, TIM_CHANNEL_3, pwm);
-
+    buzzer_hw_on(&buzzer_hw_board, psc, pwm);
 }
 
 /**
-  * @brief          رշ
+  * @brief          رհط
   * @param[in]      none
   * @retval         none
   */
 void buzzer_drv_off(void)
 {
-    __HAL_TIM_SetCompare(&re_htim4, TIM_CHANNEL_3, 0);
+    buzzer_hw_off(&buzzer_hw_board);
 }
@@ -9,11 +9,14 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Sep-19-2020     LionHeart       1. done
+  *  V1.1.0     Oct-19-2026     LionHeart       1. ӿʱTIM4ͣ񡢹ضʱӼٻָ
+  *  V1.2.0     Oct-19-2026     LionHeart       1. Ӳչֶ֧
   *
   @verbatim
   ==============================================================================
   
 	Ͷ壺struct_typedef.h
+	Ӳ󶨶壺buzzer_TIM_init.h
   ==============================================================================
   @endverbatim
   *************************(C) COPYRIGHT 2020 LionHeart*************************
@@ -23,10 +26,72 @@
 #define __BSP_BUZZER_DRIVER_H
 
 #include "struct_typedef.h"
+#include "buzzer_TIM_init.h"
+
+//Ӳ󶨶ӦͨıȽϼĴTIM_CHANNEL_xȡֵǡΪCCRxCCR1ֽƫ
+#define BUZZER_HW_CCR(hw) (*(&(hw)->instance->CCR1 + ((hw)->channel >> 2U)))
+
+
+/**
+ * @brief          ָʱķƵֵֹͣմӿ
+ *                 ָװӰӼĴʹһ
+ *                 ʼصȴ
+ * @param[in]      hwӲ󶨣Ϊstatic constʵ
+ * @param[in]      pscöʱķƵϵ
+ * @param[in]      pwmöʱıȽֵ
+ * @retval         none
+ */
+__STATIC_INLINE void buzzer_hw_on(const buzzer_hw_t *hw, uint16_t psc, uint16_t pwm)
+{
+    hw->instance->PSC = psc;
+    BUZZER_HW_CCR(hw) = pwm;
+    if ((hw->instance->CR1 & TIM_CR1_CEN) == 0)
+    {
+        hw->instance->EGR = TIM_EGR_UG;
+        hw->instance->CR1 |= TIM_CR1_CEN;
+    }
+}
+
+/**
+  * @brief          رָ
+  * @param[in]      hwӲ󶨣Ϊstatic constʵ
+  * @retval         none
+  */
+__STATIC_INLINE void buzzer_hw_off(const buzzer_hw_t *hw)
+{
+    BUZZER_HW_CCR(hw) = 0;
+}
+
+/**
+  * @brief          ָУͺֹͣض϶ʱʱ
+  * @param[in]      hwӲ󶨣Ϊstatic constʵ
+  * @retval         none
+  */
+__STATIC_INLINE void buzzer_hw_sleep(const buzzer_hw_t *hw)
+{
+    //ȽϼĴԤװأ¼ʹռձ0Ч֤ضʱűֵ͵ƽ
+    BUZZER_HW_CCR(hw) = 0;
+    hw->instance->EGR = TIM_EGR_UG;
+    //__HAL_TIM_DISABLE()ͨʹʱCENֱӲĴ
+    hw->instance->CR1 &= ~TIM_CR1_CEN;
+    *hw->tim_clk_enr &= ~hw->tim_clk_mask;
+}
+
+/**
+  * @brief          ָ˳Уָʱʱӣһbuzzer_hw_on()ʱ
+  * @param[in]      hwӲ󶨣Ϊstatic constʵ
+  * @retval         none
+  */
+__STATIC_INLINE void buzzer_hw_wakeup(const buzzer_hw_t *hw)
+{
+    //ضʱӲḴλĴPSCARRͨþֲ
+    *hw->tim_clk_enr |= hw->tim_clk_mask;
+    (void)*hw->tim_clk_enr;
+}
 
 
 /**
- * @brief          ƷʱķƵֵ
+ * @brief          ưطʱķƵֵ
  * @param[in]      pscöʱķƵϵ
  * @param[in]      pwmöʱֵ
  * @retval         none
@@ -34,7 +99,7 @@
 extern void buzzer_drv_on(uint16_t psc, uint16_t pwm);
 
 /**
-  * @brief          رշ
+  * @brief          رհط
   * @param[in]      none
   * @retval         none
   */
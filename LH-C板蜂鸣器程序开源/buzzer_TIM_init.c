@@ -10,6 +10,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Sep-19-2020     LionHeart       1. done
+  *  V1.1.0     Oct-19-2026     LionHeart       1. ʱ/ͨ/ŸΪھ̬ãֶ֧
   *
   @verbatim
   ==============================================================================
@@ -25,47 +26,91 @@
 //ΪCubeMXԶɵĴһ
 TIM_HandleTypeDef re_htim4;
 
+//ѱռõĶʱռľھܾͬһʱӲ
+static struct
+{
+	TIM_TypeDef *instance;
+	TIM_HandleTypeDef *htim;
+} buzzer_tim_claimed[BUZZER_TIM_MAX];
+
 /**
   * @brief          ֲHAL⣺HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
-  * @param[in]      none
+  * @param[in]      hw: Ӳ
   * @retval         none
   */
-HAL_StatusTypeDef TIM_Base_Init_buzzer(TIM_HandleTypeDef *htim);
-
+HAL_StatusTypeDef TIM_Base_Init_buzzer(const buzzer_hw_t *hw);
 
 /**
-  * @brief          ֲHAL⣺MX_TIM4_Init(void);
-  * @param[in]      none
+  * @brief          ֲCubeMXԶɴ룺HAL_TIM_Base_MspInit(TIM_HandleTypeDef *tim_baseHandle);
+  * @param[in]      hw: Ӳ
   * @retval         none
   */
-void MXY_TIM4_Init(void)
+void TIM_Base_MspInit_buzzer(const buzzer_hw_t *hw);
+
+
+/**
+  * @brief          Ӳ󶨳ʼĶʱPWMͨ
+  * @param[in]      hw: Ӳ
+  * @retval         HAL_OKʱѱʹİռû򳬹BUZZER_TIM_MAXʱHAL_ERROR
+  *                 ͬһ󶨣ͬһظã³ʼʱ
+  */
+HAL_StatusTypeDef buzzer_TIM_init(const buzzer_hw_t *hw)
 {
 	TIM_ClockConfigTypeDef sClockSourceConfig = { 0 };
 	TIM_MasterConfigTypeDef sMasterConfig = { 0 };
 	TIM_OC_InitTypeDef sConfigOC = { 0 };
+	TIM_HandleTypeDef *htim = hw->htim;
+	uint32_t primask;
+	uint8_t i;
+
+	//ǼǶʱʵͬʱʼǼǹ̲ɱ
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for (i = 0; i < BUZZER_TIM_MAX; i++)
+	{
+		//ͬһظʼͬһʱģռʱܾ
+		if (buzzer_tim_claimed[i].instance == hw->instance)
+		{
+			if (buzzer_tim_claimed[i].htim == hw->htim)
+				break;
+			__set_PRIMASK(primask);
+			return HAL_ERROR;
+		}
+		if (buzzer_tim_claimed[i].instance == NULL)
+		{
+			buzzer_tim_claimed[i].instance = hw->instance;
+			buzzer_tim_claimed[i].htim = hw->htim;
+			break;
+		}
+	}
+	__set_PRIMASK(primask);
+	if (i == BUZZER_TIM_MAX)
+	{
+		return HAL_ERROR;
+	}
 
-	re_htim4.Instance = TIM4;
-	re_htim4.Init.Prescaler = 167;
-	re_htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
-	re_htim4.Init.Period = 65535;
-	re_htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-	re_htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
-	if (TIM_Base_Init_buzzer(&re_htim4) != HAL_OK)
+	htim->Instance = hw->instance;
+	htim->Init.Prescaler = 167;
+	htim->Init.CounterMode = TIM_COUNTERMODE_UP;
+	htim->Init.Period = 65535;
+	htim->Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	htim->Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+	if (TIM_Base_Init_buzzer(hw) != HAL_OK)
 	{
 		;
 	}
 	sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
-	if (HAL_TIM_ConfigClockSource(&re_htim4, &sClockSourceConfig) != HAL_OK)
+	if (HAL_TIM_ConfigClockSource(htim, &sClockSourceConfig) != HAL_OK)
 	{
 		;
 	}
-	if (HAL_TIM_PWM_Init(&re_htim4) != HAL_OK)
+	if (HAL_TIM_PWM_Init(htim) != HAL_OK)
 	{
 		;
 	}
 	sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
 	sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
-	if (HAL_TIMEx_MasterConfigSynchronization(&re_htim4, &sMasterConfig) != HAL_OK)
+	if (HAL_TIMEx_MasterConfigSynchronization(htim, &sMasterConfig) != HAL_OK)
 	{
 		;
 	}
@@ -73,75 +118,85 @@ void MXY_TIM4_Init(void)
 	sConfigOC.Pulse = 0;
 	sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
 	sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
-	if (HAL_TIM_PWM_ConfigChannel(&re_htim4, &sConfigOC, TIM_CHANNEL_3) != HAL_OK)
+	if (HAL_TIM_PWM_ConfigChannel(htim, &sConfigOC, hw->channel) != HAL_OK)
 	{
 		;
 	}
-	TIM_MspPostInit_buzzer(&re_htim4);
+	TIM_MspPostInit_buzzer(hw);
+	return HAL_OK;
 }
 
-
 /**
-  * @brief          ֲCubeMXԶɴ룺HAL_TIM_Base_MspInit(TIM_HandleTypeDef *tim_baseHandle);
+  * @brief          ֲHAL⣺MX_TIM4_Init(void);
+  *                 ʱгʼbuzzer_hw_boardٵñ
+  *                 ΪݾɵĵôظʼӰĶʱռ
   * @param[in]      none
   * @retval         none
   */
-void TIM_Base_MspInit_buzzer(TIM_HandleTypeDef *tim_baseHandle)
+void MXY_TIM4_Init(void)
 {
-	if (tim_baseHandle->Instance == TIM4)
+	if (buzzer_TIM_init(&buzzer_hw_board) != HAL_OK)
 	{
-		/* TIM4 clock enable */
-		__HAL_RCC_TIM4_CLK_ENABLE();
+		;
 	}
 }
 
+
+/**
+  * @brief          ֲCubeMXԶɴ룺HAL_TIM_Base_MspInit(TIM_HandleTypeDef *tim_baseHandle);
+  * @param[in]      hw: Ӳ
+  * @retval         none
+  */
+void TIM_Base_MspInit_buzzer(const buzzer_hw_t *hw)
+{
+	/* TIM clock enable */
+	*hw->tim_clk_enr |= hw->tim_clk_mask;
+	/* Delay after an RCC peripheral clock enabling */
+	(void)*hw->tim_clk_enr;
+}
+
 /**
   * @brief          ֲCubeMXԶɴ룺HAL_TIM_MspPostInit(TIM_HandleTypeDef *timHandle);
-  * @param[in]      none
+  * @param[in]      hw: Ӳ
   * @retval         none
   */
-void TIM_MspPostInit_buzzer(TIM_HandleTypeDef *timHandle)
+void TIM_MspPostInit_buzzer(const buzzer_hw_t *hw)
 {
 	GPIO_InitTypeDef GPIO_InitStruct = { 0 };
-	if (timHandle->Instance == TIM4)
-	{
-		__HAL_RCC_GPIOD_CLK_ENABLE();
-		/**TIM4 GPIO Configuration
-		PD14     ------> TIM4_CH3
-		*/
-		GPIO_InitStruct.Pin = BUZZER_Pin;
-		GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-		GPIO_InitStruct.Pull = GPIO_PULLUP;
-		GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
-		GPIO_InitStruct.Alternate = GPIO_AF2_TIM4;
-		HAL_GPIO_Init(BUZZER_GPIO_Port, &GPIO_InitStruct);
-
-		HAL_TIM_Base_Start(&re_htim4);
-		HAL_TIM_PWM_Start(&re_htim4, TIM_CHANNEL_3);
-	}
+
+	RCC->AHB1ENR |= hw->gpio_clk_mask;
+	(void)RCC->AHB1ENR;
+	GPIO_InitStruct.Pin = hw->gpio_pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Pull = GPIO_PULLUP;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+	GPIO_InitStruct.Alternate = hw->gpio_af;
+	HAL_GPIO_Init(hw->gpio_port, &GPIO_InitStruct);
+
+	HAL_TIM_Base_Start(hw->htim);
+	HAL_TIM_PWM_Start(hw->htim, hw->channel);
 }
 
 /**
   * @brief          ֲCubeMXԶɴ룺HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *tim_baseHandle);
-  * @param[in]      none
+  * @param[in]      hw: Ӳ
   * @retval         none
   */
-void TIM_Base_MspDeInit_buzzer(TIM_HandleTypeDef *tim_baseHandle)
+void TIM_Base_MspDeInit_buzzer(const buzzer_hw_t *hw)
 {
-	if (tim_baseHandle->Instance == TIM4)
-	{
-		/* Peripheral clock disable */
-		__HAL_RCC_TIM4_CLK_DISABLE();
-	}
+	/* Peripheral clock disable */
+	*hw->tim_clk_enr &= ~hw->tim_clk_mask;
 }
 
 /**
   * @brief          ֲHAL⣺HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
-  * @param[in]      none
+  * @param[in]      hw: Ӳ
   * @retval         none
   */
-HAL_StatusTypeDef TIM_Base_Init_buzzer(TIM_HandleTypeDef *htim)
+HAL_StatusTypeDef TIM_Base_Init_buzzer(const buzzer_hw_t *hw)
 {
+	TIM_HandleTypeDef *htim = hw->htim;
+
 	/* Check the TIM handle allocation */
 	if (htim == NULL)
 	{
@@ -159,7 +214,7 @@ HAL_StatusTypeDef TIM_Base_Init_buzzer(TIM_HandleTypeDef *htim)
 		/* Allocate lock resource and initialize it */
 		htim->Lock = HAL_UNLOCKED;
 		/* Init the low level hardware : GPIO, CLOCK, NVIC */
-		TIM_Base_MspInit_buzzer(htim);
+		TIM_Base_MspInit_buzzer(hw);
 		/* USE_HAL_TIM_REGISTER_CALLBACKS */
 	}
 
@@ -10,6 +10,7 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Sep-19-2020     LionHeart       1. done
+  *  V1.1.0     Oct-19-2026     LionHeart       1. ʱ/ͨ/ŸΪھ̬ãֶ֧
   *
   @verbatim
   ==============================================================================
@@ -35,8 +36,60 @@
 //ΪCubeMXԶɵĴһ
 extern TIM_HandleTypeDef re_htim4;
 
+//Ӳ󶨵͡ʵ붨Ϊstatic constʹڱ
+//۵Ϊ̶ļĴַʱκʱӷʡ
+//ÿӲ󶨱ռһʱйضϻֹͣضʱʱӣ
+//ʱĸ¼ḴλPSCҲɸͨábuzzer_TIM_init()ܾ
+//ڶʹͬһʱİ
+typedef struct
+{
+	TIM_HandleTypeDef *htim;        //ʱʼʱʹ
+	TIM_TypeDef *instance;          //ʱTIM4
+	uint32_t channel;               //PWMͨTIM_CHANNEL_1 ~ TIM_CHANNEL_4
+	uint8_t gpio_af;                //ŸùܣGPIO_AF2_TIM4
+	GPIO_TypeDef *gpio_port;        //Ŷ˿
+	uint16_t gpio_pin;              //
+	uint32_t gpio_clk_mask;         //Ŷ˿RCC->AHB1ENRеʱʹλ
+	__IO uint32_t *tim_clk_enr;     //ʱʱʹܼĴ&RCC->APB1ENR
+	uint32_t tim_clk_mask;          //ʱʱʹλRCC_APB1ENR_TIM4EN
+}buzzer_hw_t;
+
+/**RM-Cط
+PD14     ------> TIM4_CH3
+*/
+static const buzzer_hw_t buzzer_hw_board =
+{
+	&re_htim4, TIM4, TIM_CHANNEL_3, GPIO_AF2_TIM4,
+	BUZZER_GPIO_Port, BUZZER_Pin, RCC_AHB1ENR_GPIODEN,
+	&RCC->APB1ENR, RCC_APB1ENR_TIM4EN
+};
+
+//ʱڴ˰ͬʽӲ󶨣buzzer_TIM_init.cж
+//䶨ʱעⶨʱãͬһʱĸͨPSC޷
+//ͬʱ첻ͬһ·йضϻжһ·졣TIM5_CH1PH10
+//ķ
+//	extern TIM_HandleTypeDef re_htim5;
+//	static const buzzer_hw_t buzzer_hw_ext =
+//	{
+//		&re_htim5, TIM5, TIM_CHANNEL_1, GPIO_AF2_TIM5,
+//		GPIOH, GPIO_PIN_10, RCC_AHB1ENR_GPIOHEN,
+//		&RCC->APB1ENR, RCC_APB1ENR_TIM5EN
+//	};
+
+//ͬʱʼķʱ
+#define BUZZER_TIM_MAX 4
+
+/**
+  * @brief          Ӳ󶨳ʼĶʱPWMͨ
+  * @param[in]      hw: Ӳ
+  * @retval         HAL_OKʱѱʹİռû򳬹BUZZER_TIM_MAXʱHAL_ERROR
+  *                 ͬһ󶨣ͬһظã³ʼʱ
+  */
+HAL_StatusTypeDef buzzer_TIM_init(const buzzer_hw_t *hw);
+
 /**
   * @brief          ֲHAL⣺MX_TIM4_Init(void);
+  *                 гʼbuzzer_hw_boardΪݾɵĵô
   * @param[in]      none
   * @retval         none
   */
@@ -44,10 +97,10 @@ void MXY_TIM4_Init(void);
     
 /**
   * @brief          ֲCubeMXԶɴ룺HAL_TIM_MspPostInit(TIM_HandleTypeDef *timHandle);
-  * @param[in]      none
+  * @param[in]      hw: Ӳ
   * @retval         none
   */
-void TIM_MspPostInit_buzzer(TIM_HandleTypeDef *htim);
+void TIM_MspPostInit_buzzer(const buzzer_hw_t *hw);
 
 #ifdef __cplusplus
 }
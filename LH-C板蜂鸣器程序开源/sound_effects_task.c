@@ -12,6 +12,9 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Sep-19-2020     LionHeart       1. done
+  *  V1.1.0     Oct-19-2026     LionHeart       1. ʱضTIM4ʱӣȴԼtickless idle
+  *  V1.2.0     Oct-19-2026     LionHeart       1. ֶ֧ʵ԰󶨶ʱ/ͨ/
+  *  V1.3.0     Oct-19-2026     LionHeart       1. ЧԽֹʱȣƯ
   *
   @verbatim
   ==============================================================================
@@ -25,7 +28,7 @@
 	2.ܵã
 		һԴļxxx.c"ҪЧҪͷļ
 			#include "sound_effects_task.h"
-		ȻҪһָ룬ʹָsound_effects_taskеbuzzer_control˴ֱ
+		ȻҪһָ룬ʹָطʵcontrolԱ˴ֱ
 		ú get_buzzer_effect_point() ȡַ磺
 			buzzer_t *buzzer = get_buzzer_effect_point();
 		Ҫڳеĳ׶ʱָЧֱӲָsound_effect
@@ -42,8 +45,31 @@
 			buzzer->work = FALSE;
 		ͣ÷ЧʱԻɵǰЧȻŻֹͣ
 		йظЧ˵sound_effects_task.hеsound_effects_tö͡
+		ʱضTIM4ʱӣȴĬÿ10msһsound_effect
+		ֱдsound_effectӦӳͬҲԸ
+			buzzer_effect_request(SYSTEM_START_BEEP);
+		еôʹøúɽBUZZER_TICKLESS_IDLE1
+		ʱڻѣFreeRTOStickless idleЧʱֱд
+		sound_effect󲻻ᱻӦ
+		ͳƣѴضʱʱget_buzzer_idle_stats_point()
+		ȡ
+		ЧÿһԽֹʱȣӳٺռɵĳٵһ
+		ЧĽĲƯơٵͳƼʵtiming_statsԱ
+		Ͻӿھطʵbuzzer_engine_boardʵͨ
+			buzzer_engine_request(&buzzer_engine_ext, B_);
+		Чbuzzer_tӿͳƷֱΪbuzzer_engine_ext.control
+		buzzer_engine_ext.idle_stats
 
-	3.ã
+	3.ӷʵ
+		ÿʵӵж״̬񣬶ʱͨڱڰ󶨣
+			buzzer_TIM_init.hжstatic const buzzer_hw_tӲ󶨣
+			  buzzer_TIM_init.cж䶨ʱÿʵռһʱ
+			  ʵöʱʵṤ
+			sound_effects_task.cBUZZER_ENGINE_DEFINEʵ
+			  sound_effects_task.h
+			ΪһFreeRTOS
+
+	4.ã
 		򻹰buzzer_TIM_init.c/hbsp_buzzer_driver.c/hļЩļ
 		ֲRM2020ٷԴ򡣱HAL⡰stm32f4xx_hal.c/hȷ
 		ֲĿ깤ʹHAL⣬Ҫbuzzer_init.c/hbsp_buzzer.c/h
@@ -71,193 +97,383 @@
   */
 
 #include "sound_effects_task.h"
-
-buzzer_t buzzer_control;
-bool_check_t buzzer_is_busy;
+#include "FreeRTOS.h"
+#include "task.h"
 
 /**
-  * @brief          buzzer_is_busyָ
+  * @brief          ذطbuzzer_is_busyָ
   * @param[in]      none
   * @retval         bool_check_t *buzzer_is_busy
   */
 const bool_check_t *get_buzzer_is_busy_point(void);
 
+/**
+  * @brief          ¼һָʱӵ׸ĺʱ
+  * @param[out]     engine: ʵ
+  * @param[in]      cycles: ĵCPU
+  * @retval         none
+  */
+static void buzzer_cold_start_record(buzzer_engine_t *engine, uint32_t cycles);
 
 /**
-  * @brief          Ч񣬼 BUZZER_TASK_CONTROL_TIME 10ms
-  * @param[in]      pvParameters: 
+  * @brief          һǴӿлָĵһ¼ʱ
+  * @param[in]      engine: ʵ
+  * @param[in]      hw: Ӳ
+  * @param[in]      psc: ʱķƵϵ
+  * @param[in]      pwm: ʱıȽֵ
   * @retval         none
   */
-void buzzer_effects_task(void const *argument)
+__STATIC_FORCEINLINE void buzzer_engine_on(buzzer_engine_t *engine, const buzzer_hw_t *hw, uint16_t psc, uint16_t pwm)
+{
+	buzzer_hw_on(hw, psc, pwm);
+	if (engine->cold_start_pending == TRUE)
+	{
+		engine->cold_start_pending = FALSE;
+		buzzer_cold_start_record(engine, DWT->CYCCNT - engine->wakeup_stamp);
+	}
+}
+
+/**
+  * @brief          ȴǰЧľԽֹʱ䡣ֹʱ䰴ۼӶʱ
+  *                 Ϊ׼ӳٺռɵĳٵһĵȴʱ䲹ֹʱ
+  *                 ȴϵͳļƣconfigTICK_RATE_HZΪ1000
+  * @param[in]      engine: ʵ
+  * @param[in]      duration: ʱms
+  * @retval         none
+  */
+static void buzzer_engine_step(buzzer_engine_t *engine, uint32_t duration)
+{
+	int32_t remain;
+	uint32_t late;
+
+	engine->deadline += pdMS_TO_TICKS(duration);
+	remain = (int32_t)(engine->deadline - xTaskGetTickCount());
+	if (remain > 0)
+		vTaskDelay((TickType_t)remain);
+
+	engine->timing_stats.step_count++;
+	remain = (int32_t)(xTaskGetTickCount() - engine->deadline);
+	if (remain > 0)
+	{
+		late = (uint32_t)remain;
+		engine->timing_stats.late_count++;
+		if (late > engine->timing_stats.late_max)
+			engine->timing_stats.late_max = late;
+		//ٵ࣬ٲԵǰʱ¶
+		if (late > pdMS_TO_TICKS(BUZZER_DEADLINE_RESYNC_TIME))
+		{
+			engine->deadline = xTaskGetTickCount();
+			engine->timing_stats.resync_count++;
+		}
+	}
+}
+
+/**
+  * @brief          ȴµЧ󣬵ǰʱʱӦѹض
+  * @param[in]      engine: ʵ
+  * @retval         none
+  */
+static void buzzer_idle_wait(buzzer_engine_t *engine)
+{
+	uint32_t idle_start;
+	osEvent event;
+
+	//кһЧԻʱΪ¶ֹʱ
+	engine->deadline_valid = FALSE;
+	idle_start = xTaskGetTickCount();
+	event = osSignalWait(BUZZER_SIGNAL_REQUEST, BUZZER_TASK_IDLE_TIME);
+	engine->idle_stats.gated_time += xTaskGetTickCount() - idle_start;
+	engine->idle_stats.wakeup_count++;
+	if (event.status == osEventSignal)
+		engine->idle_stats.request_count++;
+}
+
+
+/**
+  * @brief          Ч棬ЧԽֹʱȡÿʵ
+  *                 չһݣhwڱȷʱֱӷʹ̶ļĴַ
+  * @param[in]      engine: ʵ
+  * @param[in]      hw: Ӳ󶨣Ϊstatic constʵ
+  * @retval         none
+  */
+__STATIC_FORCEINLINE void buzzer_engine_run(buzzer_engine_t *engine, const buzzer_hw_t *hw)
 {
 	//ʼ־λ
-	buzzer_control.is_busy = get_buzzer_is_busy_point();
-	buzzer_is_busy = FALSE;   
-	buzzer_control.work = TRUE; 
-	buzzer_control.sound_effect = STOP;  
+	engine->control.is_busy = &engine->is_busy;
+	engine->is_busy = FALSE;   
+	engine->control.work = TRUE; 
+	engine->control.sound_effect = STOP;  
+	engine->is_gated = FALSE;
+	engine->task_handle = osThreadGetId();
+	engine->deadline_valid = FALSE;
+
+	//DWTڼڲʱ
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
 	//ȴģʼ
 	osDelay(500);
-	//ʼTIM4Ϊ
-	MXY_TIM4_Init();
+	//ʼʱΪ
+	if (buzzer_TIM_init(hw) != HAL_OK)
+	{
+		//ʱѱռãʵٹҲٲöʱ
+		engine->control.work = FALSE;
+		for (;;)
+			osDelay(osWaitForever);
+	}
 	//رշ
-	buzzer_drv_off();
+	buzzer_hw_off(hw);
 	//һΡЧҪڴʹã뽫ע
-	buzzer_control.sound_effect = SYSTEM_START_BEEP;
+	engine->control.sound_effect = SYSTEM_START_BEEP;
 
 	for (;;)
 	{
-		//鹤־Ƿλ
-		if (buzzer_control.work == TRUE)
+		//鹤־ǷλЧҪ
+		if (engine->control.work == TRUE && engine->control.sound_effect != STOP)
 		{
-			switch (buzzer_control.sound_effect)
+			//ʱڿйض״̬Ȼָʱ
+			if (engine->is_gated == TRUE)
 			{
-			case STOP:
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
-				break;
+				//buzzer_engine_request()ʱʱ̿ʼʱӴ˿̿ʼ
+				engine->wakeup_stamp = (engine->request_stamped == TRUE) ? engine->request_stamp : DWT->CYCCNT;
+				engine->request_stamped = FALSE;
+				buzzer_hw_wakeup(hw);
+				engine->is_gated = FALSE;
+				engine->cold_start_pending = TRUE;
+			}
 
+			//ӿпʼЧԵǰʱΪ㣻ЧһֵĽֹʱ䣬
+			//ʹB_CONTINUE/D_CONTINUEĽĲӳƯ
+			if (engine->deadline_valid == FALSE)
+			{
+				engine->deadline = xTaskGetTickCount();
+				engine->deadline_valid = TRUE;
+			}
+
+			switch (engine->control.sound_effect)
+			{
 			case SYSTEM_START_BEEP:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(3, 10000);	osDelay(333);
-				buzzer_drv_on(2, 10000);	osDelay(333);
-				buzzer_drv_on(1, 10000);	osDelay(333);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 3, 10000);	buzzer_engine_step(engine, 333);
+				buzzer_engine_on(engine, hw, 2, 10000);	buzzer_engine_step(engine, 333);
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 333);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			case B_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			case B_B_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			case B_B_B_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			case B___:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(1, 10000);	osDelay(500);
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 500);
+				engine->is_busy = FALSE;
 				break;
 
 			case B_CONTINUE:
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(1, 10000);	osDelay(100);
-				buzzer_drv_off();           osDelay(50);
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 100);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 50);
 				break;
 
 			case D_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				engine->is_busy = FALSE;
 				break;
 
 			case D_D_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			case D_D_D_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			case D___:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(4, 10000);    osDelay(500);
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 500);
+				engine->is_busy = FALSE;
 				break;
 
 			case D_CONTINUE:
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(4, 10000);    osDelay(100);
-				buzzer_drv_off();           osDelay(50);
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 100);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 50);
 				break;
 
 			case D_B_B_:
-				buzzer_control.sound_effect = STOP;
-				buzzer_is_busy = TRUE;
-				buzzer_drv_on(4, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();			osDelay(70);
-				buzzer_drv_on(1, 10000);	osDelay(70);
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				engine->is_busy = TRUE;
+				buzzer_engine_on(engine, hw, 4, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);						buzzer_engine_step(engine, 70);
+				buzzer_engine_on(engine, hw, 1, 10000);	buzzer_engine_step(engine, 70);
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 
 			default:
-				buzzer_control.sound_effect = STOP;
-				buzzer_drv_off();
-				buzzer_is_busy = FALSE;
+				engine->control.sound_effect = STOP;
+				buzzer_hw_off(hw);
+				engine->is_busy = FALSE;
 				break;
 			}
 		}
-		else if (buzzer_control.sound_effect != STOP)
+		else
 		{
-			buzzer_control.sound_effect = STOP;
-			buzzer_drv_off();
-			buzzer_is_busy = FALSE;
+			//ͣʱδִеЧ
+			if (engine->control.work != TRUE)
+				engine->control.sound_effect = STOP;
+			engine->is_busy = FALSE;
+			//ض϶ʱʱӺ
+			if (engine->is_gated == FALSE)
+			{
+				//ڼ䵽ѱѹĻźźʱ̣
+				//кЧ
+				osSignalWait(BUZZER_SIGNAL_REQUEST, 0);
+				engine->request_stamped = FALSE;
+				buzzer_hw_sleep(hw);
+				engine->is_gated = TRUE;
+				engine->idle_stats.gate_count++;
+			}
+			//źǰյ󲻻ٻټһ
+			if (engine->control.work != TRUE || engine->control.sound_effect == STOP)
+				buzzer_idle_wait(engine);
 		}
-		osDelay(BUZZER_TASK_CONTROL_TIME);  //10ms
 	}
 }
 
+/**
+  * @brief          ¼һָʱӵ׸ĺʱ
+  * @param[out]     engine: ʵ
+  * @param[in]      cycles: ĵCPU
+  * @retval         none
+  */
+static void buzzer_cold_start_record(buzzer_engine_t *engine, uint32_t cycles)
+{
+	engine->idle_stats.cold_start_cycles = cycles;
+	if (cycles > engine->idle_stats.cold_start_max)
+		engine->idle_stats.cold_start_max = cycles;
+	if (cycles > BUZZER_COLD_START_LIMIT)
+		engine->idle_stats.cold_start_overrun++;
+}
+
+
+//һʵhwΪstatic constӲ
+#define BUZZER_ENGINE_DEFINE(task, engine, hw)	\
+	buzzer_engine_t engine;						\
+	void task(void const *argument)				\
+	{											\
+		(void)argument;							\
+		buzzer_engine_run(&engine, &hw);		\
+	}
+
+//طʵΪbuzzer_effects_task()
+BUZZER_ENGINE_DEFINE(buzzer_effects_task, buzzer_engine_board, buzzer_hw_board)
+
+//ʱڴ˶ʵsound_effects_task.h磺
+//	BUZZER_ENGINE_DEFINE(buzzer_ext_effects_task, buzzer_engine_ext, buzzer_hw_ext)
+
 
 /**
-  * @brief          طָ
+  * @brief          ذطָ
   * @param[in]      none
-  * @retval         buzzer_t *buzzer_control
+  * @retval         buzzer_t *buzzer_engine_board.control
   */
 buzzer_t *get_buzzer_effect_point(void)
 {
-	return &buzzer_control;
+	return &buzzer_engine_board.control;
+}
+
+/**
+  * @brief          ΪָһЧѴڿеĸʵ
+  * @param[in]      engine: ʵ
+  * @param[in]      sound_effect: ЧöٳԱ
+  * @retval         none
+  */
+void buzzer_engine_request(buzzer_engine_t *engine, sound_effects_t sound_effect)
+{
+	//ʱ
+	engine->request_stamp = DWT->CYCCNT;
+	engine->request_stamped = TRUE;
+	engine->control.sound_effect = sound_effect;
+	if (engine->task_handle != NULL)
+		osSignalSet(engine->task_handle, BUZZER_SIGNAL_REQUEST);
+}
+
+/**
+  * @brief          ΪطһЧѴڿеķ
+  * @param[in]      sound_effect: ЧöٳԱ
+  * @retval         none
+  */
+void buzzer_effect_request(sound_effects_t sound_effect)
+{
+	buzzer_engine_request(&buzzer_engine_board, sound_effect);
+}
+
+/**
+  * @brief          ذطͳָ
+  * @param[in]      none
+  * @retval         const buzzer_idle_stats_t *buzzer_idle_stats
+  */
+const buzzer_idle_stats_t *get_buzzer_idle_stats_point(void)
+{
+	return &buzzer_engine_board.idle_stats;
 }
 
 /**
-  * @brief          buzzer_is_busyָ
+  * @brief          ذطbuzzer_is_busyָ
   * @param[in]      none
   * @retval         bool_check_t *buzzer_is_busy
   */
 const bool_check_t *get_buzzer_is_busy_point(void)
 {
-	return &buzzer_is_busy;
+	return &buzzer_engine_board.is_busy;
 }
@@ -12,6 +12,9 @@
   * @history
   *  Version    Date            Author          Modification
   *  V1.0.0     Sep-19-2020     LionHeart       1. done
+  *  V1.1.0     Oct-19-2026     LionHeart       1. ʱضTIM4ʱӣȴԼtickless idle
+  *  V1.2.0     Oct-19-2026     LionHeart       1. ֶ֧ʵ԰󶨶ʱ/ͨ/
+  *  V1.3.0     Oct-19-2026     LionHeart       1. ЧԽֹʱȣƯ
   *
   @verbatim
   ==============================================================================
@@ -25,7 +28,7 @@
 	2.ܵã
 		һԴļxxx.c"ҪЧҪͷļ
 			#include "sound_effects_task.h"
-		ȻҪһָ룬ʹָsound_effects_taskеbuzzer_control˴ֱ
+		ȻҪһָ룬ʹָطʵcontrolԱ˴ֱ
 		ú get_buzzer_effect_point() ȡַ磺
 			buzzer_t *buzzer = get_buzzer_effect_point();
 		Ҫڳеĳ׶ʱָЧֱӲָsound_effect
@@ -42,8 +45,31 @@
 			buzzer->work = FALSE;
 		ͣ÷ЧʱԻɵǰЧȻŻֹͣ
 		йظЧ˵sound_effects_task.hеsound_effects_tö͡
+		ʱضTIM4ʱӣȴĬÿ10msһsound_effect
+		ֱдsound_effectӦӳͬҲԸ
+			buzzer_effect_request(SYSTEM_START_BEEP);
+		еôʹøúɽBUZZER_TICKLESS_IDLE1
+		ʱڻѣFreeRTOStickless idleЧʱֱд
+		sound_effect󲻻ᱻӦ
+		ͳƣѴضʱʱget_buzzer_idle_stats_point()
+		ȡ
+		ЧÿһԽֹʱȣӳٺռɵĳٵһ
+		ЧĽĲƯơٵͳƼʵtiming_statsԱ
+		Ͻӿھطʵbuzzer_engine_boardʵͨ
+			buzzer_engine_request(&buzzer_engine_ext, B_);
+		Чbuzzer_tӿͳƷֱΪbuzzer_engine_ext.control
+		buzzer_engine_ext.idle_stats
 
-	3.ã
+	3.ӷʵ
+		ÿʵӵж״̬񣬶ʱͨڱڰ󶨣
+			buzzer_TIM_init.hжstatic const buzzer_hw_tӲ󶨣
+			  buzzer_TIM_init.cж䶨ʱÿʵռһʱ
+			  ʵöʱʵṤ
+			sound_effects_task.cBUZZER_ENGINE_DEFINEʵ
+			  sound_effects_task.h
+			ΪһFreeRTOS
+
+	4.ã
 		򻹰buzzer_TIM_init.c/hbsp_buzzer_driver.c/hļЩļ
 		ֲRM2020ٷԴ򡣱HAL⡰stm32f4xx_hal.c/hȷ
 		ֲĿ깤ʹHAL⣬Ҫbuzzer_init.c/hbsp_buzzer.c/h
@@ -80,8 +106,31 @@ extern "C" {
 #include "bsp_buzzer_driver.h"
 #include "cmsis_os.h"
 
-//Ч10ms鲻Ҫ30
-#define BUZZER_TASK_CONTROL_TIME 10
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE __STATIC_INLINE
+#endif
+
+//Чٵmsٵֵʱɺ貹ʱ
+//ʱռԵǰʱ¶룬ѹһ
+#define BUZZER_DEADLINE_RESYNC_TIME 30
+//зʽѡ0ĬϣʱÿBUZZER_TASK_IDLE_TIMEһΣֱд
+//sound_effectĵ÷ʽӦӳԭ10msͬ1ʱ
+//ֻbuzzer_effect_request()/buzzer_engine_request()ѣFreeRTOStickless idle
+//Чʱֱдsound_effect󲻻ᱻӦ
+#ifndef BUZZER_TICKLESS_IDLE
+#define BUZZER_TICKLESS_IDLE 0
+#endif
+//ʱʱ䣬ms
+#if BUZZER_TICKLESS_IDLE
+#define BUZZER_TASK_IDLE_TIME osWaitForever
+#else
+#define BUZZER_TASK_IDLE_TIME 10
+#endif
+//ѷʹõź
+#define BUZZER_SIGNAL_REQUEST 0x01
+//ʱޣCPUȡpsc = 1ARR = 65535һڣ
+//TIM4ʱΪHCLKһ룬Ϊ 2 * 65536 * 2
+#define BUZZER_COLD_START_LIMIT (2U * 65536U * 2U)
 
 // ----- ЧעûԵõĸЧµЧڴöٳԱ
 typedef enum
@@ -116,21 +165,85 @@ typedef struct
 	sound_effects_t sound_effect;   //ЧʹܣдЧöٳԱЧ
 }buzzer_t;
 
+//ͳƵ
+typedef struct
+{
+	uint32_t wakeup_count;          //󱻻ѵĴʱѣ
+	uint32_t request_count;         //buzzer_engine_request()ĻѴ
+	uint32_t gate_count;            //ʱʱӱضϵĴ
+	uint32_t gated_time;            //ʱʱӴڹض״̬ۼʱϵͳ
+	uint32_t cold_start_cycles;     //һCPUbuzzer_engine_request()õ׸
+	                                //ӳ٣ֱдsound_effectʱֻƻָʱӵ׸
+	uint32_t cold_start_max;        //CPUֵ
+	uint32_t cold_start_overrun;    //BUZZER_COLD_START_LIMITĴ
+}buzzer_idle_stats_t;
+
+//ʱͳƵͣʱ䵥λΪϵͳģ1/configTICK_RATE_HZ룩
+typedef struct
+{
+	uint32_t step_count;            //ִеЧ
+	uint32_t late_count;            //ʱѳֹʱĲ
+	uint32_t late_max;              //ʱԽֹʱٵ
+	uint32_t resync_count;          //ٵBUZZER_DEADLINE_RESYNC_TIME¶Ĵ
+}buzzer_timing_stats_t;
+
+//һʵͣÿʵӵж״̬
+typedef struct
+{
+	buzzer_t control;                   //ûӿ
+	bool_check_t is_busy;               //æ־control.is_busyָ
+	bool_check_t is_gated;              //ʱʱǷѹض
+	bool_check_t cold_start_pending;    //ʱǷδͳ
+	uint32_t wakeup_stamp;              //ʱDWTڼ
+	bool_check_t request_stamped;       //request_stampǷЧ
+	uint32_t request_stamp;             //һbuzzer_engine_request()ʱDWTڼ
+	bool_check_t deadline_valid;        //ֹʱǷѶ뵽ǰЧ
+	uint32_t deadline;                  //ǰЧľԽֹʱ䣬ϵͳ
+	buzzer_idle_stats_t idle_stats;     //ͳ
+	buzzer_timing_stats_t timing_stats; //ʱͳ
+	osThreadId task_handle;             //ʵڻ
+}buzzer_engine_t;
+
+//طʵΪbuzzer_effects_task()
+extern buzzer_engine_t buzzer_engine_board;
+
+
+/**
+  * @brief          طЧЧԽֹʱ
+  * @param[in]      pvParameters: 
+  * @retval         none
+  */
+extern void buzzer_effects_task(void const *argument);
+
 
 /**
   * @brief          طָ
   * @param[in]      none
   * @retval         buzzer_t ָ
   */
-extern void buzzer_effects_task(void const *argument);
+extern buzzer_t *get_buzzer_effect_point(void);
 
+/**
+  * @brief          ΪָһЧѴڿеĸʵ
+  * @param[in]      engine: ʵ
+  * @param[in]      sound_effect: ЧöٳԱ
+  * @retval         none
+  */
+extern void buzzer_engine_request(buzzer_engine_t *engine, sound_effects_t sound_effect);
 
 /**
-  * @brief          Ч񣬼 BUZZER_TASK_CONTROL_TIME 10ms
-  * @param[in]      pvParameters: 
+  * @brief          ΪطһЧѴڿеķ
+  * @param[in]      sound_effect: ЧöٳԱ
   * @retval         none
   */
-extern buzzer_t *get_buzzer_effect_point(void);
+extern void buzzer_effect_request(sound_effects_t sound_effect);
+
+/**
+  * @brief          ذطͳָ
+  * @param[in]      none
+  * @retval         const buzzer_idle_stats_t ͳָ
+  */
+extern const buzzer_idle_stats_t *get_buzzer_idle_stats_point(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,258 @@
+/**
+  *************************(C) COPYRIGHT 2020 LionHeart*************************
+  * @file       buzzer_timing_bench.c
+  * @brief      Чʱ˲ԡģϵͳĺȣÿ
+  *             ˯ߺռӳ٣B_CONTINUE/D_CONTINUE飺
+  *             ֹʱϸЧۼӣʱֵͬûƯ
+  *             ÿʼʱʱ̵BUZZER_DEADLINE_RESYNC_TIME
+  *             ٵlate_maxBUZZER_DEADLINE_RESYNC_TIMEû¶
+  *
+  * @note
+  * @history
+  *  Version    Date            Author          Modification
+  *  V1.0.0     Oct-19-2026     LionHeart       1. done
+  *
+  @verbatim
+  ==============================================================================
+  УڲֿĿ¼£
+	gcc -I test/stub -I LH-CԴ test/buzzer_timing_bench.c
+	    LH-CԴ/sound_effects_task.c LH-CԴ/buzzer_TIM_init.c
+	    -o test/buzzer_timing_bench && ./test/buzzer_timing_bench
+	ɼ -DconfigTICK_RATE_HZ=500 ϵͳĲΪ1000Hzʱı֡
+	ȫͨʱ0
+  ==============================================================================
+  @endverbatim
+  *************************(C) COPYRIGHT 2020 LionHeart*************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "sound_effects_task.h"
+
+//ÿ׶μ
+#define BENCH_EDGES 1000
+//ЧĽģ100msֹͣ50ms
+#define BENCH_ON_TICKS    pdMS_TO_TICKS(100)
+#define BENCH_PERIOD      (pdMS_TO_TICKS(100) + pdMS_TO_TICKS(50))
+
+//Խ׶ΣЧÿ˯߱ռĸʣٷֱȣռӳ٣ms
+typedef struct
+{
+	const char *name;
+	sound_effects_t sound_effect;
+	int preempt_percent;
+	uint32_t preempt_max;
+}bench_phase_t;
+
+static const bench_phase_t bench_phases[] =
+{
+	{ "B_CONTINUE, light load", B_CONTINUE, 30, 11 },
+	{ "D_CONTINUE, heavy load", D_CONTINUE, 70, 25 },
+};
+#define BENCH_PHASE_NUM ((int)(sizeof(bench_phases) / sizeof(bench_phases[0])))
+
+TIM_TypeDef stub_tim4;
+GPIO_TypeDef stub_gpiod;
+RCC_TypeDef stub_rcc;
+DWT_Type stub_dwt;
+CoreDebug_Type stub_core_debug;
+
+static TickType_t bench_tick;
+static jmp_buf bench_exit;
+static int bench_phase = -1;        //-1ΪЧ
+static int bench_edges;
+static TickType_t bench_anchor;
+static uint32_t bench_last_ccr;
+static uint32_t bench_edge_err_max;
+static int bench_failures;
+
+static void bench_check(int ok, const char *what, long value)
+{
+	if (!ok)
+	{
+		printf("  FAIL: %s (%ld)\n", what, value);
+		bench_failures++;
+	}
+}
+
+/**
+  * @brief          أʼʱֹʱ
+  * @param[in]      none
+  * @retval         none
+  */
+static void bench_sample(void)
+{
+	uint32_t ccr = stub_tim4.CCR3;
+	uint32_t err;
+
+	if (bench_phase >= 0 && ccr != 0 && bench_last_ccr == 0 && bench_edges < BENCH_EDGES)
+	{
+		//첽ʼ⵽ʱֹʱѼʱ
+		bench_check(buzzer_engine_board.deadline - bench_anchor
+			== (TickType_t)bench_edges * BENCH_PERIOD + BENCH_ON_TICKS,
+			"deadline drifted at edge", bench_edges);
+		err = bench_tick - (bench_anchor + (TickType_t)bench_edges * BENCH_PERIOD);
+		if (err > bench_edge_err_max)
+			bench_edge_err_max = err;
+		bench_edges++;
+		if (bench_edges == BENCH_EDGES)
+			buzzer_engine_board.control.sound_effect = STOP;
+	}
+	bench_last_ccr = ccr;
+}
+
+/**
+  * @brief          һ׶Σͳ
+  * @param[in]      none
+  * @retval         none
+  */
+static void bench_phase_end(void)
+{
+	const buzzer_timing_stats_t *t = &buzzer_engine_board.timing_stats;
+	uint32_t limit = pdMS_TO_TICKS(BUZZER_DEADLINE_RESYNC_TIME);
+
+	printf("%s: edges %d, span %lu ticks (ideal %lu), edge error max %lu, "
+		"steps %lu, late %lu, late_max %lu, resync %lu\n",
+		bench_phases[bench_phase].name, bench_edges,
+		(unsigned long)(buzzer_engine_board.deadline - bench_anchor),
+		(unsigned long)((TickType_t)BENCH_EDGES * BENCH_PERIOD),
+		(unsigned long)bench_edge_err_max, (unsigned long)t->step_count,
+		(unsigned long)t->late_count, (unsigned long)t->late_max,
+		(unsigned long)t->resync_count);
+	bench_check(bench_edges == BENCH_EDGES, "edge count", bench_edges);
+	bench_check(buzzer_engine_board.deadline - bench_anchor == (TickType_t)BENCH_EDGES * BENCH_PERIOD,
+		"total span differs from ideal", (long)(buzzer_engine_board.deadline - bench_anchor));
+	bench_check(bench_edge_err_max <= limit, "edge error above BUZZER_DEADLINE_RESYNC_TIME", (long)bench_edge_err_max);
+	bench_check(t->late_max <= limit, "late_max above BUZZER_DEADLINE_RESYNC_TIME", (long)t->late_max);
+	bench_check(t->resync_count == 0, "unexpected resync", (long)t->resync_count);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+	bench_sample();
+	return bench_tick;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+	const bench_phase_t *phase;
+
+	bench_sample();
+	bench_tick += xTicksToDelay;
+	//ʱܱȼռ
+	if (bench_phase >= 0)
+	{
+		phase = &bench_phases[bench_phase];
+		if (rand() % 100 < phase->preempt_percent)
+			bench_tick += pdMS_TO_TICKS((uint32_t)rand() % (phase->preempt_max + 1));
+	}
+}
+
+osStatus osDelay(uint32_t millisec)
+{
+	if (millisec == osWaitForever)
+	{
+		printf("FAIL: engine parked, buzzer_TIM_init() rejected the binding\n");
+		exit(1);
+	}
+	bench_tick += pdMS_TO_TICKS(millisec);
+	return osOK;
+}
+
+osThreadId osThreadGetId(void)
+{
+	return (osThreadId)&buzzer_engine_board;
+}
+
+int32_t osSignalSet(osThreadId thread_id, int32_t signals)
+{
+	(void)thread_id;
+	return signals;
+}
+
+osEvent osSignalWait(int32_t signals, uint32_t millisec)
+{
+	osEvent event;
+
+	(void)signals;
+	//㳬ʱѹźţƽԽ׶
+	if (millisec == 0)
+	{
+		event.status = osEventTimeout;
+		event.value.signals = 0;
+		return event;
+	}
+	if (bench_phase >= 0)
+		bench_phase_end();
+	if (++bench_phase == BENCH_PHASE_NUM)
+		longjmp(bench_exit, 1);
+
+	//һʱһ׶εЧԻʱ̶ֹʱ
+	bench_tick += (millisec == osWaitForever) ? pdMS_TO_TICKS(100) : pdMS_TO_TICKS(millisec);
+	bench_anchor = bench_tick;
+	bench_edges = 0;
+	bench_edge_err_max = 0;
+	buzzer_engine_board.timing_stats = (buzzer_timing_stats_t){ 0 };
+	buzzer_engine_board.control.sound_effect = bench_phases[bench_phase].sound_effect;
+	event.status = osEventTimeout;
+	event.value.signals = 0;
+	return event;
+}
+
+void TIM_Base_SetConfig(TIM_TypeDef *TIMx, TIM_Base_InitTypeDef *Structure)
+{
+	TIMx->PSC = Structure->Prescaler;
+	TIMx->ARR = Structure->Period;
+}
+
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef *htim, TIM_ClockConfigTypeDef *sClockSourceConfig)
+{
+	(void)htim; (void)sClockSourceConfig;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim)
+{
+	(void)htim;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig)
+{
+	(void)htim; (void)sMasterConfig;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+	(void)htim; (void)sConfig; (void)Channel;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+	htim->Instance->CR1 |= TIM_CR1_CEN;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+	(void)htim; (void)Channel;
+	return HAL_OK;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+	(void)GPIOx; (void)GPIO_Init;
+}
+
+int main(void)
+{
+	srand(2020);
+	if (setjmp(bench_exit) == 0)
+		buzzer_effects_task(NULL);
+
+	printf(bench_failures == 0 ? "PASS\n" : "FAILED: %d check(s)\n", bench_failures);
+	return bench_failures == 0 ? 0 : 1;
+}
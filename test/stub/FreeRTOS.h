@@ -0,0 +1,20 @@
+/**
+  * @file       FreeRTOS.h
+  * @brief      ˲õFreeRTOSʱ-DconfigTICK_RATE_HZ=500
+  *             ıϵͳƵʡ
+  */
+
+#ifndef __STUB_FREERTOS_H
+#define __STUB_FREERTOS_H
+
+#include <stdint.h>
+
+#ifndef configTICK_RATE_HZ
+#define configTICK_RATE_HZ 1000
+#endif
+
+typedef uint32_t TickType_t;
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFU)
+#define pdMS_TO_TICKS(xTimeInMs) ((TickType_t)(((TickType_t)(xTimeInMs) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+
+#endif
@@ -0,0 +1,28 @@
+/**
+  * @file       cmsis_os.h
+  * @brief      ˲õCMSIS-RTOS v1buzzer_timing_bench.cʵ֡
+  */
+
+#ifndef __STUB_CMSIS_OS_H
+#define __STUB_CMSIS_OS_H
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define osWaitForever 0xFFFFFFFFU
+
+typedef void *osThreadId;
+typedef enum { osOK = 0, osEventSignal = 0x08, osEventTimeout = 0x40 } osStatus;
+typedef struct
+{
+	osStatus status;
+	union { int32_t signals; } value;
+} osEvent;
+
+osStatus osDelay(uint32_t millisec);
+osThreadId osThreadGetId(void);
+int32_t osSignalSet(osThreadId thread_id, int32_t signals);
+osEvent osSignalWait(int32_t signals, uint32_t millisec);
+
+#endif
@@ -0,0 +1,88 @@
+/**
+  * @file       stm32f4xx_hal.h
+  * @brief      ˲õHALṩõ͡Ĵͺ
+  *             Ĵӳ䵽ͨbuzzer_timing_bench.c塣
+  */
+
+#ifndef __STUB_STM32F4XX_HAL_H
+#define __STUB_STM32F4XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO volatile
+#define __STATIC_INLINE static inline
+
+typedef enum { HAL_OK = 0x00U, HAL_ERROR = 0x01U } HAL_StatusTypeDef;
+typedef enum { HAL_UNLOCKED = 0x00U } HAL_LockTypeDef;
+typedef enum { HAL_TIM_STATE_RESET = 0x00U, HAL_TIM_STATE_READY, HAL_TIM_STATE_BUSY } HAL_TIM_StateTypeDef;
+
+typedef struct { __IO uint32_t CR1, EGR, CCER, CNT, PSC, ARR, CCR1, CCR2, CCR3, CCR4; } TIM_TypeDef;
+typedef struct { uint32_t MODER; } GPIO_TypeDef;
+typedef struct { __IO uint32_t AHB1ENR, APB1ENR; } RCC_TypeDef;
+typedef struct { __IO uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { __IO uint32_t DEMCR; } CoreDebug_Type;
+
+extern TIM_TypeDef stub_tim4;
+extern GPIO_TypeDef stub_gpiod;
+extern RCC_TypeDef stub_rcc;
+extern DWT_Type stub_dwt;
+extern CoreDebug_Type stub_core_debug;
+#define TIM4        (&stub_tim4)
+#define GPIOD       (&stub_gpiod)
+#define RCC         (&stub_rcc)
+#define DWT         (&stub_dwt)
+#define CoreDebug   (&stub_core_debug)
+
+typedef struct { uint32_t Prescaler, CounterMode, Period, ClockDivision, AutoReloadPreload; } TIM_Base_InitTypeDef;
+typedef struct { TIM_TypeDef *Instance; TIM_Base_InitTypeDef Init; HAL_LockTypeDef Lock; HAL_TIM_StateTypeDef State; } TIM_HandleTypeDef;
+typedef struct { uint32_t ClockSource; } TIM_ClockConfigTypeDef;
+typedef struct { uint32_t MasterOutputTrigger, MasterSlaveMode; } TIM_MasterConfigTypeDef;
+typedef struct { uint32_t OCMode, Pulse, OCPolarity, OCFastMode; } TIM_OC_InitTypeDef;
+typedef struct { uint32_t Pin, Mode, Pull, Speed, Alternate; } GPIO_InitTypeDef;
+
+#define TIM_CR1_CEN                     0x0001U
+#define TIM_EGR_UG                      0x0001U
+#define TIM_CHANNEL_1                   0x0000U
+#define TIM_CHANNEL_2                   0x0004U
+#define TIM_CHANNEL_3                   0x0008U
+#define TIM_CHANNEL_4                   0x000CU
+#define TIM_COUNTERMODE_UP              0x0000U
+#define TIM_CLOCKDIVISION_DIV1          0x0000U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE  0x0000U
+#define TIM_CLOCKSOURCE_INTERNAL        0x1000U
+#define TIM_TRGO_RESET                  0x0000U
+#define TIM_MASTERSLAVEMODE_DISABLE     0x0000U
+#define TIM_OCMODE_PWM1                 0x0060U
+#define TIM_OCPOLARITY_HIGH             0x0000U
+#define TIM_OCFAST_DISABLE              0x0000U
+#define GPIO_PIN_14                     0x4000U
+#define GPIO_MODE_AF_PP                 0x0002U
+#define GPIO_PULLUP                     0x0001U
+#define GPIO_SPEED_FREQ_VERY_HIGH       0x0003U
+#define GPIO_AF2_TIM4                   0x02U
+#define RCC_AHB1ENR_GPIODEN             0x0008U
+#define RCC_APB1ENR_TIM4EN              0x0004U
+#define CoreDebug_DEMCR_TRCENA_Msk      0x01000000U
+#define DWT_CTRL_CYCCNTENA_Msk          0x0001U
+
+#define assert_param(expr)              ((void)0U)
+#define IS_TIM_INSTANCE(x)              1
+#define IS_TIM_COUNTER_MODE(x)          1
+#define IS_TIM_CLOCKDIVISION_DIV(x)     1
+#define IS_TIM_AUTORELOAD_PRELOAD(x)    1
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void) { return 0U; }
+__STATIC_INLINE void __set_PRIMASK(uint32_t primask) { (void)primask; }
+__STATIC_INLINE void __disable_irq(void) { }
+
+void TIM_Base_SetConfig(TIM_TypeDef *TIMx, TIM_Base_InitTypeDef *Structure);
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef *htim, TIM_ClockConfigTypeDef *sClockSourceConfig);
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+
+#endif
@@ -0,0 +1,11 @@
+/**
+  * @file       struct_typedef.h
+  * @brief      ˲õͶ
+  */
+
+#ifndef __STUB_STRUCT_TYPEDEF_H
+#define __STUB_STRUCT_TYPEDEF_H
+
+#include <stdint.h>
+
+#endif
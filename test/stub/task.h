@@ -0,0 +1,14 @@
+/**
+  * @file       task.h
+  * @brief      ˲õFreeRTOSӿbuzzer_timing_bench.cʵ֡
+  */
+
+#ifndef __STUB_TASK_H
+#define __STUB_TASK_H
+
+#include "FreeRTOS.h"
+
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(const TickType_t xTicksToDelay);
+
+#endif